@@ -59,6 +59,16 @@ namespace state
   //
   //  A template statemashine has been written that can be copied and pasted
   //  as a starting point and then be modified.
+  //
+  //  Ownership between threads:
+  //
+  //    a statemachine has no thread affinity and no event queue of its own.
+  //    triggers are plain calls made by the owner. to move a statemachine to
+  //    another thread (e.g. to rebalance load), the owner stops feeding it on
+  //    the old thread between two triggers, hands over the statemachine
+  //    together with its pending events and the user reference, and resumes
+  //    on the new thread. the current state is unaffected by the move.
+  //    events, their ordering and the hand-over belong to the user.
 
   using named::t_prefix;
   using named::t_void;